@@ -9,37 +9,115 @@
 #include <cstdlib>
 #include <cctype>
 #include <cstring>
+#include <cerrno>
+#include <climits>
+#include <fstream>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <unordered_set>
+#include <cstdio>
+#include <cmath>
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
 
 using namespace std;
 
+// ---------------------- Text pool ----------------------
+
+// All room, item and enemy text lives in one buffer of NUL-terminated strings.
+// Structs hold 32-bit offsets into it, and identical strings are stored once,
+// so two refs are equal exactly when their text is.
+typedef uint32_t TextRef;
+
+const TextRef EMPTY_TEXT = 0;   // offset 0 always holds ""
+
+string textPool;
+
+// Pointer into the pool; only valid until the next internText()
+const char* text(TextRef ref) {
+    return textPool.c_str() + ref;
+}
+
+// The dedup index stores only offsets and hashes/compares the pooled text
+// itself, so no string is kept twice
+struct PooledTextHash {
+    size_t operator()(TextRef ref) const {
+        size_t h = 2166136261u;  // FNV-1a
+        for (const char* p = text(ref); *p; ++p) h = (h ^ (unsigned char)*p) * 16777619u;
+        return h;
+    }
+};
+
+struct PooledTextEqual {
+    bool operator()(TextRef a, TextRef b) const {
+        return a == b || strcmp(text(a), text(b)) == 0;
+    }
+};
+
+unordered_set<TextRef, PooledTextHash, PooledTextEqual> textIndex;
+
+void resetTextPool() {
+    textPool.assign(1, '\0');
+    textIndex.clear();
+    textIndex.insert(EMPTY_TEXT);
+}
+
+TextRef internText(const string& s) {
+    // append first so the lookup can hash the pooled copy; drop it again if
+    // the text was already there
+    TextRef ref = (TextRef)textPool.size();
+    textPool.append(s);
+    textPool.push_back('\0');
+    unordered_set<TextRef, PooledTextHash, PooledTextEqual>::const_iterator found = textIndex.find(ref);
+    if (found != textIndex.end()) {
+        textPool.resize(ref);
+        return *found;
+    }
+    textIndex.insert(ref);
+    return ref;
+}
+
+bool textIs(TextRef ref, const char* s) {
+    return strcmp(text(ref), s) == 0;
+}
+
 // ---------------------- Structures ----------------------
 
 struct Item {
-    string name;
-    string description;
+    TextRef name;
+    TextRef description;
     bool usable;        // can be "used" (e.g., key, potion)
     int healAmount;     // if usable and heals
     bool isKey;         // unlock doors
     bool isRelic;       // relic required to win
+    unsigned matchStamp; // last name lookup that listed this item (see matchItem)
 };
 
 struct Enemy {
-    string name;
+    TextRef name;
     int hp;
+    int maxHp;          // hp from the content, used to carry damage across a reload
     int attack;
-    string taunt;
+    TextRef taunt;
 };
 
 struct Room {
-    string name;
-    string description;
+    TextRef name;
+    TextRef description;
     // Connections: indices into the rooms array; -1 means no connection
     int north, south, east, west;
     Item* items[6];     // small fixed array for items in the room, NULL if empty
     int itemCount;
     Enemy* enemy;       // enemy pointer (NULL if none)
     bool locked;        // locked room (needs key or relic)
-    string keyName;     // name of item that unlocks (if locked)
+    TextRef keyName;    // name of item that unlocks (if locked)
 };
 
 // ---------------------- Constants ----------------------
@@ -47,14 +125,21 @@ struct Room {
 const int ROOM_COUNT = 6;
 const int INVENTORY_CAP = 8;
 const int MAX_ROOM_ITEMS = 6;
+const int MAX_WORLD_ITEMS = 16;
+const int MAX_WORLD_ENEMIES = 8;
+const int TOWER_ROOM = 5;   // the game logic refers to rooms by index, never by (editable) name
+
+// Optional content file read at startup and by the 'reload' command
+const char* CONTENT_FILE = "manor.txt";
 
 // ---------------------- Global game state ----------------------
 
 Room rooms[ROOM_COUNT];
-Item* allItems[16];   // for cleanup
+Item* allItems[MAX_WORLD_ITEMS];   // for cleanup
 int allItemsCount = 0;
-Enemy* allEnemies[8];
+Enemy* allEnemies[MAX_WORLD_ENEMIES];
 int allEnemiesCount = 0;
+int worldVersion = 0;  // bumped every time the world content is (re)loaded
 
 Item* inventory[INVENTORY_CAP];
 int invCount = 0;
@@ -86,22 +171,24 @@ bool stringStartsWith(const string &s, const string &prefix) {
 
 Item* makeItem(const string& name, const string& desc, bool usable=false, int heal=0, bool key=false, bool relic=false) {
     Item* it = new Item();
-    it->name = name;
-    it->description = desc;
+    it->name = internText(name);
+    it->description = internText(desc);
     it->usable = usable;
     it->healAmount = heal;
     it->isKey = key;
     it->isRelic = relic;
+    it->matchStamp = 0;
     allItems[allItemsCount++] = it;
     return it;
 }
 
 Enemy* makeEnemy(const string& name, int hp, int attack, const string& taunt="") {
     Enemy* e = new Enemy();
-    e->name = name;
+    e->name = internText(name);
     e->hp = hp;
+    e->maxHp = hp;
     e->attack = attack;
-    e->taunt = taunt;
+    e->taunt = internText(taunt);
     allEnemies[allEnemiesCount++] = e;
     return e;
 }
@@ -126,7 +213,7 @@ int findItemIndexInRoom(Room &r, const string &name) {
     string lname = name;
     toLowerInPlace(lname);
     for (int i = 0; i < r.itemCount; ++i) {
-        string iname = r.items[i]->name;
+        string iname = text(r.items[i]->name);
         string inamel = iname;
         toLowerInPlace(inamel);
         if (inamel == lname) return i;
@@ -139,7 +226,7 @@ int findItemIndexInInventory(const string &name) {
     toLowerInPlace(lname);
     for (int i = 0; i < invCount; ++i) {
         if (!inventory[i]) continue;
-        string inamel = inventory[i]->name;
+        string inamel = text(inventory[i]->name);
         toLowerInPlace(inamel);
         if (inamel == lname) return i;
     }
@@ -161,6 +248,158 @@ void removeFromInventory(int idx) {
     invCount--;
 }
 
+// ---------------------- Item name index ----------------------
+
+// Case-folded trie over item names, rebuilt whenever the world is loaded.
+// Every word start of a name is inserted ("relic of gloom", "of gloom", "gloom"),
+// so the player can type any word of a name, or the start of it.
+struct TrieNode {
+    vector<pair<char, int> > children;  // (character, node index)
+    vector<Item*> items;                // items with a name (word) passing through this node
+    vector<Item*> exact;                // items whose full name ends here
+};
+
+vector<TrieNode> nameTrie;
+
+const int AMBIGUOUS_MATCH = -2;  // more than one item fits what the player typed
+
+int trieChild(int node, char c) {
+    for (size_t i = 0; i < nameTrie[node].children.size(); ++i)
+        if (nameTrie[node].children[i].first == c) return nameTrie[node].children[i].second;
+    return -1;
+}
+
+void trieInsert(const string& key, Item* it, bool fullName) {
+    int node = 0;
+    for (char c : key) {
+        int next = trieChild(node, c);
+        if (next == -1) {
+            next = (int)nameTrie.size();
+            nameTrie[node].children.push_back(make_pair(c, next));
+            nameTrie.push_back(TrieNode());
+        }
+        node = next;
+        // the same item can reach a node through two of its words; keep it once
+        if (nameTrie[node].items.empty() || nameTrie[node].items.back() != it)
+            nameTrie[node].items.push_back(it);
+    }
+    if (fullName) nameTrie[node].exact.push_back(it);
+}
+
+void buildNameIndex() {
+    nameTrie.clear();
+    nameTrie.push_back(TrieNode());  // root
+    for (int i = 0; i < allItemsCount; ++i) {
+        string lname = text(allItems[i]->name);
+        toLowerInPlace(lname);
+        for (size_t start = 0; start < lname.size(); ++start) {
+            if (start > 0 && lname[start-1] != ' ') continue;
+            if (lname[start] == ' ') continue;
+            trieInsert(lname.substr(start), allItems[i], start == 0);
+        }
+    }
+}
+
+// Scratch space reused by every lookup, so matching does not allocate:
+// one edit-distance row per trie depth, and the fuzzy hits found so far
+vector<vector<int> > fuzzyRows;
+vector<Item*> fuzzyHits;
+unsigned matchGeneration = 0;
+
+// Walk down the trie along a prefix fuzzily, collecting items whose name
+// (or one of its words) starts within maxEdits edits of the query.
+// fuzzyRows[depth-1] holds the row of the parent node. Only cells within
+// maxEdits of the diagonal can stay in range, so only that band is filled;
+// the cell on each side of it is set to maxEdits+1 for the next row to read.
+void trieFuzzyCollect(int node, char c, int depth, const string& q, int maxEdits) {
+    int cols = (int)q.size() + 1;
+    int lo = max(1, depth - maxEdits);
+    int hi = min(cols - 1, depth + maxEdits);
+    if (lo > hi) return;
+    const vector<int>& prevRow = fuzzyRows[depth-1];
+    vector<int>& row = fuzzyRows[depth];
+    row[0] = depth;
+    if (lo > 1) row[lo-1] = maxEdits + 1;
+    int best = row[0];
+    for (int i = lo; i <= hi; ++i) {
+        int ins = row[i-1] + 1;
+        int del = prevRow[i] + 1;
+        int rep = prevRow[i-1] + (q[i-1] == c ? 0 : 1);
+        row[i] = min(ins, min(del, rep));
+        best = min(best, row[i]);
+    }
+    if (hi + 1 < cols) row[hi+1] = maxEdits + 1;
+    if (hi == cols - 1 && row[cols-1] <= maxEdits) {
+        // everything below this node shares the matching prefix
+        fuzzyHits.insert(fuzzyHits.end(), nameTrie[node].items.begin(), nameTrie[node].items.end());
+        return;
+    }
+    if (best > maxEdits) return;
+    for (size_t i = 0; i < nameTrie[node].children.size(); ++i)
+        trieFuzzyCollect(nameTrie[node].children[i].second, nameTrie[node].children[i].first, depth + 1, q, maxEdits);
+}
+
+// Pick the one entry of scope[] that appears in candidates.
+// Returns -1 if none does, AMBIGUOUS_MATCH if several do.
+// Candidates are stamped first, so this is one pass over each list.
+int pickFromScope(Item* const* scope, int count, const vector<Item*>& candidates) {
+    if (candidates.empty()) return -1;
+    if (++matchGeneration == 0) {
+        // stamps wrapped around: clear the old ones so they can't match
+        for (int i = 0; i < allItemsCount; ++i) allItems[i]->matchStamp = 0;
+        matchGeneration = 1;
+    }
+    for (size_t k = 0; k < candidates.size(); ++k) candidates[k]->matchStamp = matchGeneration;
+    int found = -1;
+    for (int i = 0; i < count; ++i) {
+        if (!scope[i] || scope[i]->matchStamp != matchGeneration) continue;
+        if (found != -1 && scope[found] != scope[i]) return AMBIGUOUS_MATCH;
+        if (found == -1) found = i;
+    }
+    return found;
+}
+
+// Resolve what the player typed to an index into scope[].
+// Tries, in order: the exact full name, a prefix of the name or of one of
+// its words, then the same with a few typos (names of 4+ letters only).
+int matchItem(Item* const* scope, int count, const string& typed) {
+    string q = typed;
+    toLowerInPlace(q);
+    size_t b = q.find_first_not_of(" \t\r");
+    size_t e = q.find_last_not_of(" \t\r");
+    if (b == string::npos || nameTrie.empty()) return -1;
+    q = q.substr(b, e - b + 1);
+
+    int node = 0;
+    for (size_t i = 0; i < q.size() && node != -1; ++i) node = trieChild(node, q[i]);
+    if (node != -1) {
+        int idx = pickFromScope(scope, count, nameTrie[node].exact);
+        if (idx != -1) return idx;
+        idx = pickFromScope(scope, count, nameTrie[node].items);
+        if (idx != -1) return idx;
+    }
+
+    if (q.size() < 4) return -1;
+    int maxEdits = q.size() >= 8 ? 2 : 1;
+    // the walk stops once depth exceeds q.size() + maxEdits (row[0] == depth)
+    size_t depths = q.size() + maxEdits + 2;
+    if (fuzzyRows.size() < depths) fuzzyRows.resize(depths);
+    for (size_t d = 0; d < depths; ++d) fuzzyRows[d].resize(q.size() + 1);
+    for (size_t i = 0; i <= q.size(); ++i) fuzzyRows[0][i] = (int)i;
+    fuzzyHits.clear();
+    for (size_t i = 0; i < nameTrie[0].children.size(); ++i)
+        trieFuzzyCollect(nameTrie[0].children[i].second, nameTrie[0].children[i].first, 1, q, maxEdits);
+    return pickFromScope(scope, count, fuzzyHits);
+}
+
+int matchItemInRoom(Room &r, const string &typed) {
+    return matchItem(r.items, r.itemCount, typed);
+}
+
+int matchItemInInventory(const string &typed) {
+    return matchItem(inventory, invCount, typed);
+}
+
 // Basic random within [min,max]
 int rnd(int minVal, int maxVal) {
     return minVal + (rand() % (maxVal - minVal + 1));
@@ -171,51 +410,51 @@ int rnd(int minVal, int maxVal) {
 void initRoomsAndItems() {
     // Initialize rooms
     for (int i = 0; i < ROOM_COUNT; ++i) {
-        rooms[i].name = "Unknown";
-        rooms[i].description = "";
+        rooms[i].name = internText("Unknown");
+        rooms[i].description = EMPTY_TEXT;
         rooms[i].north = rooms[i].south = rooms[i].east = rooms[i].west = -1;
         rooms[i].itemCount = 0;
         rooms[i].enemy = nullptr;
         rooms[i].locked = false;
-        rooms[i].keyName = "";
+        rooms[i].keyName = EMPTY_TEXT;
         for (int j = 0; j < MAX_ROOM_ITEMS; ++j) rooms[i].items[j] = nullptr;
     }
 
     // Room 0: Grand Hall
-    rooms[0].name = "Grand Hall";
-    rooms[0].description = "A lofty hall with portraits whose eyes seem to follow you. Exits: east to Study, south to Kitchen, up to Tower (east & south).";
+    rooms[0].name = internText("Grand Hall");
+    rooms[0].description = internText("A lofty hall with portraits whose eyes seem to follow you. Exits: east to Study, south to Kitchen, up to Tower (east & south).");
     rooms[0].east = 1; // Study
     rooms[0].south = 3; // Kitchen
 
     // Room 1: Study
-    rooms[1].name = "Study";
-    rooms[1].description = "Shelves of dusty books and a large oak desk. There's a locked chest here and a strange symbol on the floor.";
+    rooms[1].name = internText("Study");
+    rooms[1].description = internText("Shelves of dusty books and a large oak desk. There's a locked chest here and a strange symbol on the floor.");
     rooms[1].west = 0;
     rooms[1].east = 2; // Library (east)
     rooms[1].locked = false;
 
     // Room 2: Library
-    rooms[2].name = "Library";
-    rooms[2].description = "Rows of old volumes. A ladder leads up, but that path is gone. A hidden alcove glows faintly.";
+    rooms[2].name = internText("Library");
+    rooms[2].description = internText("Rows of old volumes. A ladder leads up, but that path is gone. A hidden alcove glows faintly.");
     rooms[2].west = 1;
 
     // Room 3: Kitchen
-    rooms[3].name = "Kitchen";
-    rooms[3].description = "An old kitchen. Pots hang from the ceiling, and a trapdoor lies partially concealed near the stove.";
+    rooms[3].name = internText("Kitchen");
+    rooms[3].description = internText("An old kitchen. Pots hang from the ceiling, and a trapdoor lies partially concealed near the stove.");
     rooms[3].north = 0;
     rooms[3].south = 4; // Basement
     rooms[3].east = 5;  // Entrance to Courtyard/Tower path (treated as Tower)
     // Room 4: Basement
-    rooms[4].name = "Basement";
-    rooms[4].description = "A damp basement. The air tastes mineral-y. You notice strange markings.";
+    rooms[4].name = internText("Basement");
+    rooms[4].description = internText("A damp basement. The air tastes mineral-y. You notice strange markings.");
     rooms[4].north = 3;
 
     // Room 5: Tower (top)
-    rooms[5].name = "Tower";
-    rooms[5].description = "The tower room. Moonlight pours through a narrow window. A guardian shadows the center.";
+    rooms[5].name = internText("Tower");
+    rooms[5].description = internText("The tower room. Moonlight pours through a narrow window. A guardian shadows the center.");
     rooms[5].west = 3;
     rooms[5].locked = true; // Locked until relics/key
-    rooms[5].keyName = "Tower Key"; // key required or relic combination
+    rooms[5].keyName = internText("Tower Key"); // key required or relic combination
 
     // Create items
     Item* potion = makeItem("Small Potion", "A vial of red liquid. Restores a modest amount of health.", true, 25, false, false);
@@ -263,6 +502,262 @@ void cleanup() {
         allEnemies[i] = nullptr;
     }
     allEnemiesCount = 0;
+    nameTrie.clear();
+    textIndex.clear();
+    textPool.clear();
+}
+
+// ---------------------- World content / reload ----------------------
+
+// Look up the live Item / Enemy objects by their (stable) name
+Item* findWorldItem(const string& name) {
+    for (int i = 0; i < allItemsCount; ++i)
+        if (allItems[i] && name == text(allItems[i]->name)) return allItems[i];
+    return nullptr;
+}
+
+Enemy* findWorldEnemy(const string& name) {
+    for (int i = 0; i < allEnemiesCount; ++i)
+        if (allEnemies[i] && name == text(allEnemies[i]->name)) return allEnemies[i];
+    return nullptr;
+}
+
+// Split a content line on '|'
+vector<string> splitFields(const string& line) {
+    vector<string> fields;
+    size_t start = 0;
+    while (true) {
+        size_t pos = line.find('|', start);
+        if (pos == string::npos) { fields.push_back(line.substr(start)); break; }
+        fields.push_back(line.substr(start, pos - start));
+        start = pos + 1;
+    }
+    return fields;
+}
+
+// Parse a whole field as a number; false if it is empty, has anything
+// after the digits, or does not fit in an int
+bool parseIntField(const string& field, int& out) {
+    if (field.empty()) return false;
+    char* end = nullptr;
+    errno = 0;
+    long v = strtol(field.c_str(), &end, 10);
+    if (*end != '\0' || errno == ERANGE || v < INT_MIN || v > INT_MAX) return false;
+    out = (int)v;
+    return true;
+}
+
+bool parseRoomIndex(const string& field, int& out) {
+    return parseIntField(field, out) && out >= 0 && out < ROOM_COUNT;
+}
+
+// Apply one content line. Returns false if the line is not understood.
+bool applyContentLine(const vector<string>& f) {
+    if (f.size() == 4 && f[0] == "room") {
+        int ri;
+        if (!parseRoomIndex(f[1], ri)) return false;
+        if (f[2] == "name") rooms[ri].name = internText(f[3]);
+        else if (f[2] == "description") rooms[ri].description = internText(f[3]);
+        else return false;
+        return true;
+    }
+    if (f.size() == 4 && f[0] == "item") {
+        Item* it = findWorldItem(f[1]);
+        if (!it) return false;
+        if (f[2] == "description") it->description = internText(f[3]);
+        else if (f[2] == "heal") {
+            int heal;
+            if (!parseIntField(f[3], heal) || heal < 0) return false;
+            it->healAmount = heal;
+            if (heal > 0) it->usable = true;
+        }
+        else return false;
+        return true;
+    }
+    if (f.size() == 4 && f[0] == "enemy") {
+        Enemy* e = findWorldEnemy(f[1]);
+        if (!e) return false;
+        if (f[2] == "hp") {
+            int hp;
+            if (!parseIntField(f[3], hp) || hp <= 0) return false;
+            e->hp = e->maxHp = hp;
+        }
+        else if (f[2] == "attack") {
+            // combat rolls attack-2 .. attack+3, so below 3 an enemy could heal the player
+            int attack;
+            if (!parseIntField(f[3], attack) || attack < 3) return false;
+            e->attack = attack;
+        }
+        else if (f[2] == "taunt") e->taunt = internText(f[3]);
+        else return false;
+        return true;
+    }
+    if (f.size() == 5 && f[0] == "newitem") {
+        int ri, heal;
+        if (!parseRoomIndex(f[1], ri) || !parseIntField(f[4], heal) || heal < 0) return false;
+        if (f[2].empty() || findWorldItem(f[2])) return false;
+        if (allItemsCount >= MAX_WORLD_ITEMS || rooms[ri].itemCount >= MAX_ROOM_ITEMS) return false;
+        placeItemInRoom(ri, makeItem(f[2], f[3], heal > 0, heal, false, false));
+        return true;
+    }
+    return false;
+}
+
+// Content file format, one entry per line ('#' starts a comment):
+//   room|<index>|name|<text>          room|<index>|description|<text>
+//   item|<name>|description|<text>    item|<name>|heal|<amount>
+//   enemy|<name>|hp|<n>               enemy|<name>|attack|<n>
+//   enemy|<name>|taunt|<text>         newitem|<room index>|<name>|<description>|<heal>
+// A missing file is not an error: the built-in content is used as is.
+void applyContentFile(const char* path) {
+    ifstream in(path);
+    if (!in) return;
+    string line;
+    int lineNo = 0;
+    while (getline(in, line)) {
+        ++lineNo;
+        if (!line.empty() && line[line.size()-1] == '\r') line.erase(line.size()-1);
+        if (line.empty() || line[0] == '#') continue;
+        if (!applyContentLine(splitFields(line))) {
+            cout << "(" << path << ":" << lineNo << ": ignoring bad content line)\n";
+        }
+    }
+}
+
+// Build the world from the built-in content plus the content file
+void loadWorld() {
+    resetTextPool();
+    initRoomsAndItems();
+    applyContentFile(CONTENT_FILE);
+    buildNameIndex();
+    textPool.shrink_to_fit();  // the world's text is complete; drop the growth slack
+    worldVersion++;
+}
+
+// Rebuild the world content while keeping the player's progress.
+// Mutable state is saved by name (items, enemies) and index (rooms),
+// the new world is built next to the old one, the state is moved over,
+// and only then are the old objects freed.
+void reloadWorld() {
+    // Save mutable state
+    string invNames[INVENTORY_CAP];
+    int savedInvCount = invCount;
+    for (int i = 0; i < invCount; ++i) invNames[i] = text(inventory[i]->name);
+
+    string roomItemNames[ROOM_COUNT][MAX_ROOM_ITEMS];
+    int roomItemCount[ROOM_COUNT];
+    bool roomLocked[ROOM_COUNT];
+    string enemyName[ROOM_COUNT];   // empty if the room's enemy is gone
+    int enemyDamage[ROOM_COUNT];
+    for (int r = 0; r < ROOM_COUNT; ++r) {
+        roomItemCount[r] = rooms[r].itemCount;
+        for (int j = 0; j < rooms[r].itemCount; ++j) roomItemNames[r][j] = text(rooms[r].items[j]->name);
+        roomLocked[r] = rooms[r].locked;
+        enemyName[r] = rooms[r].enemy ? text(rooms[r].enemy->name) : "";
+        enemyDamage[r] = rooms[r].enemy ? rooms[r].enemy->maxHp - rooms[r].enemy->hp : 0;
+    }
+    int currentIndex = (int)(currentRoom - rooms);
+
+    // The old text pool goes away with loadWorld(), so copy the old items out
+    struct SavedItem {
+        string name, description;
+        bool usable, isKey, isRelic;
+        int healAmount;
+    };
+    SavedItem oldItemCopies[MAX_WORLD_ITEMS];
+    for (int i = 0; i < allItemsCount; ++i) {
+        SavedItem &c = oldItemCopies[i];
+        c.name = text(allItems[i]->name);
+        c.description = text(allItems[i]->description);
+        c.usable = allItems[i]->usable;
+        c.isKey = allItems[i]->isKey;
+        c.isRelic = allItems[i]->isRelic;
+        c.healAmount = allItems[i]->healAmount;
+    }
+
+    // Keep the old objects alive until the state has been moved over
+    Item* oldItems[MAX_WORLD_ITEMS];
+    int oldItemsCount = allItemsCount;
+    for (int i = 0; i < allItemsCount; ++i) { oldItems[i] = allItems[i]; allItems[i] = nullptr; }
+    Enemy* oldEnemies[MAX_WORLD_ENEMIES];
+    int oldEnemiesCount = allEnemiesCount;
+    for (int i = 0; i < allEnemiesCount; ++i) { oldEnemies[i] = allEnemies[i]; allEnemies[i] = nullptr; }
+    allItemsCount = 0;
+    allEnemiesCount = 0;
+
+    loadWorld();
+
+    // An item the player holds, or left lying in a room, that the new content
+    // no longer defines is carried over as it was instead of vanishing
+    bool keptAny = false;
+    for (int k = 0; k < oldItemsCount; ++k) {
+        const SavedItem &c = oldItemCopies[k];
+        if (findWorldItem(c.name)) continue;
+        bool inUse = false;
+        for (int i = 0; i < savedInvCount && !inUse; ++i) inUse = invNames[i] == c.name;
+        for (int r = 0; r < ROOM_COUNT && !inUse; ++r)
+            for (int j = 0; j < roomItemCount[r] && !inUse; ++j) inUse = roomItemNames[r][j] == c.name;
+        if (!inUse) continue;
+        if (allItemsCount >= MAX_WORLD_ITEMS) {
+            cout << "(" << c.name << " is no longer in the world content and was removed.)\n";
+            continue;
+        }
+        makeItem(c.name, c.description, c.usable, c.healAmount, c.isKey, c.isRelic);
+        cout << "(Kept " << c.name << ": it is no longer in the world content.)\n";
+        keptAny = true;
+    }
+    if (keptAny) buildNameIndex();
+
+    // Items that did not exist before the reload keep their default placement
+    for (int r = 0; r < ROOM_COUNT; ++r) {
+        Item* fresh[MAX_ROOM_ITEMS];
+        int freshCount = 0;
+        for (int j = 0; j < rooms[r].itemCount; ++j) {
+            bool known = false;
+            for (int k = 0; k < oldItemsCount; ++k)
+                if (oldItemCopies[k].name == text(rooms[r].items[j]->name)) { known = true; break; }
+            if (!known) fresh[freshCount++] = rooms[r].items[j];
+        }
+        for (int j = 0; j < MAX_ROOM_ITEMS; ++j) rooms[r].items[j] = nullptr;
+        rooms[r].itemCount = 0;
+        for (int j = 0; j < roomItemCount[r]; ++j) {
+            Item* it = findWorldItem(roomItemNames[r][j]);
+            if (it) placeItemInRoom(r, it);
+        }
+        for (int j = 0; j < freshCount; ++j) {
+            if (rooms[r].itemCount >= MAX_ROOM_ITEMS) {
+                cout << "(New item " << text(fresh[j]->name) << " does not fit in the " << text(rooms[r].name) << " and was left out.)\n";
+                continue;
+            }
+            placeItemInRoom(r, fresh[j]);
+        }
+
+        rooms[r].locked = roomLocked[r];
+        if (enemyName[r].empty()) {
+            rooms[r].enemy = nullptr;
+        } else {
+            Enemy* e = findWorldEnemy(enemyName[r]);
+            if (e) {
+                e->hp = e->maxHp - enemyDamage[r];
+                if (e->hp < 1) e->hp = 1;
+            }
+            rooms[r].enemy = e;
+        }
+    }
+
+    invCount = 0;
+    for (int i = 0; i < INVENTORY_CAP; ++i) inventory[i] = nullptr;
+    for (int i = 0; i < savedInvCount; ++i) {
+        Item* it = findWorldItem(invNames[i]);
+        if (it) addToInventory(it);
+    }
+    currentRoom = &rooms[currentIndex];
+
+    // Nothing points at the old objects any more
+    for (int i = 0; i < oldItemsCount; ++i) delete oldItems[i];
+    for (int i = 0; i < oldEnemiesCount; ++i) delete oldEnemies[i];
+
+    cout << "World content reloaded (version " << worldVersion << ").\n";
 }
 
 // ---------------------- Display / UI functions ----------------------
@@ -272,7 +767,7 @@ void showHeader() {
     cout << "       MYSTIC MANOR - ADVENTURE     \n";
     cout << "====================================\n";
     cout << "HP: " << playerHP << " | Relics: " << relicsCollected() << "/3 | Moves: " << movesTaken << "\n";
-    cout << "Location: " << currentRoom->name << "\n\n";
+    cout << "Location: " << text(currentRoom->name) << "\n\n";
 }
 
 void showHelp() {
@@ -286,23 +781,25 @@ void showHelp() {
          << "  inv                         : Show inventory\n"
          << "  map                         : View a short map hint\n"
          << "  status                      : Show status (HP, relics)\n"
+         << "  stats                       : Show records from all games played\n"
+         << "  reload                      : Reload the world content file\n"
          << "  help                        : Show this help\n"
          << "  quit                        : Exit game\n";
 }
 
 // Show room contents
 void describeCurrentRoom() {
-    cout << currentRoom->description << "\n";
+    cout << text(currentRoom->description) << "\n";
     if (currentRoom->itemCount > 0) {
         cout << "\nItems here:\n";
         for (int i = 0; i < currentRoom->itemCount; ++i) {
-            cout << " - " << currentRoom->items[i]->name << "\n";
+            cout << " - " << text(currentRoom->items[i]->name) << "\n";
         }
     } else {
         cout << "\nNo visible items.\n";
     }
     if (currentRoom->enemy) {
-        cout << "\nAn enemy looms: " << currentRoom->enemy->name << " -- " << currentRoom->enemy->taunt << "\n";
+        cout << "\nAn enemy looms: " << text(currentRoom->enemy->name) << " -- " << text(currentRoom->enemy->taunt) << "\n";
     }
     cout << "\nExits:";
     if (currentRoom->north != -1) cout << " north";
@@ -320,10 +817,10 @@ void showInventory() {
     }
     cout << "Inventory (" << invCount << "/" << INVENTORY_CAP << "):\n";
     for (int i = 0; i < invCount; ++i) {
-        cout << i+1 << ". " << inventory[i]->name;
+        cout << i+1 << ". " << text(inventory[i]->name);
         if (inventory[i]->isRelic) cout << " (Relic)";
         if (inventory[i]->isKey) cout << " (Key)";
-        cout << " - " << inventory[i]->description << "\n";
+        cout << " - " << text(inventory[i]->description) << "\n";
     }
 }
 
@@ -337,6 +834,214 @@ void showMapHint() {
          << "               [4]Basement\n\n";
 }
 
+// ---------------------- Statistics ----------------------
+
+// Aggregates over every game played, kept in STATS_FILE between runs.
+// Everything is a fixed-size counter or a short list, so the file stays
+// small no matter how many games have been played. A game re-reads the file
+// just before adding its result and swaps the new version in with a rename,
+// so a result is only lost if two games finish at the same moment (the
+// last writer wins; there is no lock).
+const char* STATS_FILE = "manor_stats.txt";
+const int MOVE_BUCKETS = 10;        // moves at victory: 0-9, 10-19, ..., 90+
+const int MOVE_BUCKET_WIDTH = 10;
+const int LEADERBOARD_SIZE = 5;
+
+struct GameStats {
+    int gamesPlayed;
+    int wins;
+    int deaths;
+    int quits;
+    int winMoves[MOVE_BUCKETS];
+    vector<pair<string, int> > deathsByEnemy;   // enemy name -> deaths
+    vector<pair<string, int> > relicOrders;     // pickup order -> games
+    vector<pair<int, string> > fastestWins;     // (moves, date), best first
+};
+
+GameStats stats;
+
+// This game's events
+string relicPickups[3];
+int relicPickupCount = 0;
+string killedBy;
+
+void bumpCount(vector<pair<string, int> >& counts, const string& key, int by = 1) {
+    for (size_t i = 0; i < counts.size(); ++i) {
+        if (counts[i].first == key) { counts[i].second += by; return; }
+    }
+    counts.push_back(make_pair(key, by));
+}
+
+bool byCountDesc(const pair<string, int>& a, const pair<string, int>& b) {
+    return a.second > b.second;
+}
+
+// Remember the first time each relic is picked up this game
+void noteRelicPickup(const string& name) {
+    for (int i = 0; i < relicPickupCount; ++i)
+        if (relicPickups[i] == name) return;
+    if (relicPickupCount < 3) relicPickups[relicPickupCount++] = name;
+}
+
+void loadStats() {
+    stats.gamesPlayed = stats.wins = stats.deaths = stats.quits = 0;
+    for (int i = 0; i < MOVE_BUCKETS; ++i) stats.winMoves[i] = 0;
+    stats.deathsByEnemy.clear();
+    stats.relicOrders.clear();
+    stats.fastestWins.clear();
+
+    ifstream in(STATS_FILE);
+    if (!in) return;
+    string key;
+    while (in >> key) {
+        if (key == "games") in >> stats.gamesPlayed;
+        else if (key == "wins") in >> stats.wins;
+        else if (key == "deaths") in >> stats.deaths;
+        else if (key == "quits") in >> stats.quits;
+        else if (key == "moves") {
+            for (int i = 0; i < MOVE_BUCKETS; ++i) in >> stats.winMoves[i];
+        } else if (key == "death" || key == "order") {
+            // rest of line: <name>|<count>
+            string rest;
+            getline(in, rest);
+            size_t bar = rest.rfind('|');
+            if (bar == string::npos) continue;
+            string name = rest.substr(1, bar - 1);
+            int count = atoi(rest.c_str() + bar + 1);
+            bumpCount(key == "death" ? stats.deathsByEnemy : stats.relicOrders, name, count);
+        } else if (key == "fast") {
+            int moves;
+            string date;
+            in >> moves >> date;
+            if ((int)stats.fastestWins.size() < LEADERBOARD_SIZE)
+                stats.fastestWins.push_back(make_pair(moves, date));
+        } else {
+            string skip;
+            getline(in, skip);
+        }
+        if (!in) break;
+    }
+    sort(stats.fastestWins.begin(), stats.fastestWins.end());
+}
+
+void saveStats() {
+    // write a private temp file, then swap it in so readers never see half a file
+    string tmp = string(STATS_FILE) + "." + to_string((long)getpid()) + ".tmp";
+    ofstream out(tmp.c_str());
+    if (!out) return;
+    out << "games " << stats.gamesPlayed << "\n";
+    out << "wins " << stats.wins << "\n";
+    out << "deaths " << stats.deaths << "\n";
+    out << "quits " << stats.quits << "\n";
+    out << "moves";
+    for (int i = 0; i < MOVE_BUCKETS; ++i) out << " " << stats.winMoves[i];
+    out << "\n";
+    for (size_t i = 0; i < stats.deathsByEnemy.size(); ++i)
+        out << "death " << stats.deathsByEnemy[i].first << "|" << stats.deathsByEnemy[i].second << "\n";
+    for (size_t i = 0; i < stats.relicOrders.size(); ++i)
+        out << "order " << stats.relicOrders[i].first << "|" << stats.relicOrders[i].second << "\n";
+    for (size_t i = 0; i < stats.fastestWins.size(); ++i)
+        out << "fast " << stats.fastestWins[i].first << " " << stats.fastestWins[i].second << "\n";
+    out.close();
+    if (!out) { remove(tmp.c_str()); return; }
+#ifdef _WIN32
+    // rename() will not replace an existing file on Windows
+    bool replaced = MoveFileExA(tmp.c_str(), STATS_FILE, MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    bool replaced = rename(tmp.c_str(), STATS_FILE) == 0;
+#endif
+    if (!replaced) {
+        // leave both files alone so no records are lost
+        cout << "(Could not update " << STATS_FILE << "; this game's records were saved to " << tmp << ".)\n";
+    }
+}
+
+// Fold the finished game into the totals and write them out.
+// Returns the leaderboard place of a win (1-based), or 0.
+int recordGameResult(bool won, bool died) {
+    int rank = 0;
+    loadStats();  // pick up games that finished while this one was running
+    stats.gamesPlayed++;
+    if (won) {
+        stats.wins++;
+        int b = movesTaken / MOVE_BUCKET_WIDTH;
+        if (b >= MOVE_BUCKETS) b = MOVE_BUCKETS - 1;
+        stats.winMoves[b]++;
+
+        char date[16];
+        time_t now = time(nullptr);
+        strftime(date, sizeof(date), "%Y-%m-%d", localtime(&now));
+        // insert after any equal score, so older wins keep their place
+        size_t pos = 0;
+        while (pos < stats.fastestWins.size() && stats.fastestWins[pos].first <= movesTaken) ++pos;
+        if ((int)pos < LEADERBOARD_SIZE) {
+            stats.fastestWins.insert(stats.fastestWins.begin() + pos, make_pair(movesTaken, string(date)));
+            if ((int)stats.fastestWins.size() > LEADERBOARD_SIZE) stats.fastestWins.pop_back();
+            rank = (int)pos + 1;
+        }
+    } else if (died) {
+        stats.deaths++;
+        bumpCount(stats.deathsByEnemy, killedBy.empty() ? "Unknown" : killedBy);
+    } else {
+        stats.quits++;
+    }
+    // only complete orders, so partial runs don't crowd out real ones
+    if (relicPickupCount == 3) {
+        string order = relicPickups[0];
+        for (int i = 1; i < relicPickupCount; ++i) order += ", " + relicPickups[i];
+        bumpCount(stats.relicOrders, order);
+    }
+    saveStats();
+    return rank;
+}
+
+// Moves-at-victory bucket holding the given fraction of wins
+string winMovesQuantile(double q) {
+    int target = (int)ceil(q * stats.wins);
+    if (target < 1) target = 1;
+    int seen = 0;
+    for (int i = 0; i < MOVE_BUCKETS; ++i) {
+        seen += stats.winMoves[i];
+        if (seen >= target) {
+            if (i == MOVE_BUCKETS - 1) return to_string(i * MOVE_BUCKET_WIDTH) + "+";
+            return to_string(i * MOVE_BUCKET_WIDTH) + "-" + to_string((i + 1) * MOVE_BUCKET_WIDTH - 1);
+        }
+    }
+    return "-";
+}
+
+void showStats() {
+    loadStats();
+    cout << "Manor records (" << stats.gamesPlayed << " games played):\n";
+    if (stats.gamesPlayed == 0) {
+        cout << "  No finished games yet.\n";
+        return;
+    }
+    cout << "  Completed: " << stats.wins << " (" << (stats.wins * 100 / stats.gamesPlayed) << "%)"
+         << " | Died: " << stats.deaths << " | Quit: " << stats.quits << "\n";
+    if (stats.wins > 0) {
+        cout << "  Moves to win: median " << winMovesQuantile(0.5)
+             << ", 90% within " << winMovesQuantile(0.9) << "\n";
+    }
+    if (!stats.deathsByEnemy.empty()) {
+        vector<pair<string, int> > d = stats.deathsByEnemy;
+        sort(d.begin(), d.end(), byCountDesc);
+        cout << "  Deaths by enemy:\n";
+        for (size_t i = 0; i < d.size(); ++i) cout << "    " << d[i].first << ": " << d[i].second << "\n";
+    }
+    if (!stats.relicOrders.empty()) {
+        vector<pair<string, int> > o = stats.relicOrders;
+        sort(o.begin(), o.end(), byCountDesc);
+        cout << "  Most common relic order:\n";
+        for (size_t i = 0; i < o.size() && i < 3; ++i) cout << "    " << o[i].first << " (" << o[i].second << ")\n";
+    }
+    if (!stats.fastestWins.empty()) {
+        cout << "  Fastest wins:\n";
+        for (size_t i = 0; i < stats.fastestWins.size(); ++i)
+            cout << "    " << i+1 << ". " << stats.fastestWins[i].first << " moves (" << stats.fastestWins[i].second << ")\n";
+    }
+}
+
 // ---------------------- Game mechanics ----------------------
 
 // Try to move in a direction. Returns whether move occurred.
@@ -361,10 +1066,10 @@ bool movePlayer(const string& dir) {
     if (target.locked) {
         // check if player has required key or has all relics
         bool unlocked = false;
-        if (!target.keyName.empty()) {
-            int keyIdx = findItemIndexInInventory(target.keyName);
+        if (target.keyName != EMPTY_TEXT) {
+            int keyIdx = findItemIndexInInventory(text(target.keyName));
             if (keyIdx != -1) {
-                cout << "You use " << inventory[keyIdx]->name << " to unlock the door.\n";
+                cout << "You use " << text(inventory[keyIdx]->name) << " to unlock the door.\n";
                 unlocked = true;
                 // optionally consume key? We'll keep key.
             }
@@ -375,7 +1080,7 @@ bool movePlayer(const string& dir) {
             unlocked = true;
         }
         if (!unlocked) {
-            cout << "The way is locked. You need '" << target.keyName << "' or the relics to access.\n";
+            cout << "The way is locked. You need '" << text(target.keyName) << "' or the relics to access.\n";
             return false;
         }
         target.locked = false; // unlock permanently
@@ -383,7 +1088,7 @@ bool movePlayer(const string& dir) {
 
     currentRoom = &rooms[nextIndex];
     movesTaken++;
-    cout << "You move " << dir << " to the " << currentRoom->name << ".\n";
+    cout << "You move " << dir << " to the " << text(currentRoom->name) << ".\n";
 
     // Encounter: if enemy present, start combat automatically (player may attempt to flee)
     if (currentRoom->enemy) {
@@ -395,16 +1100,24 @@ bool movePlayer(const string& dir) {
 
 // Inspect item name either in room or inventory
 void inspectItem(const string& name) {
-    int idx = findItemIndexInRoom(*currentRoom, name);
+    int idx = matchItemInRoom(*currentRoom, name);
+    if (idx == AMBIGUOUS_MATCH) {
+        cout << "Which one? Be more specific.\n";
+        return;
+    }
     if (idx != -1) {
         Item* it = currentRoom->items[idx];
-        cout << it->name << ": " << it->description << "\n";
+        cout << text(it->name) << ": " << text(it->description) << "\n";
+        return;
+    }
+    idx = matchItemInInventory(name);
+    if (idx == AMBIGUOUS_MATCH) {
+        cout << "Which one? Be more specific.\n";
         return;
     }
-    idx = findItemIndexInInventory(name);
     if (idx != -1) {
         Item* it = inventory[idx];
-        cout << it->name << ": " << it->description << "\n";
+        cout << text(it->name) << ": " << text(it->description) << "\n";
         return;
     }
     cout << "No such item here or in your inventory.\n";
@@ -412,7 +1125,11 @@ void inspectItem(const string& name) {
 
 // Take item from room into inventory
 void takeItem(const string& name) {
-    int idx = findItemIndexInRoom(*currentRoom, name);
+    int idx = matchItemInRoom(*currentRoom, name);
+    if (idx == AMBIGUOUS_MATCH) {
+        cout << "Which one? Be more specific.\n";
+        return;
+    }
     if (idx == -1) {
         cout << "Item not found here.\n";
         return;
@@ -423,16 +1140,21 @@ void takeItem(const string& name) {
         return;
     }
     removeItemFromRoom(*currentRoom, idx);
-    cout << "You take the " << it->name << ".\n";
+    cout << "You take the " << text(it->name) << ".\n";
     // Some items may trigger immediate events
     if (it->isRelic) {
         cout << "The relic hums faintly as you grasp it.\n";
+        noteRelicPickup(text(it->name));
     }
 }
 
 // Drop item from inventory into current room
 void dropItem(const string& name) {
-    int idx = findItemIndexInInventory(name);
+    int idx = matchItemInInventory(name);
+    if (idx == AMBIGUOUS_MATCH) {
+        cout << "Which one? Be more specific.\n";
+        return;
+    }
     if (idx == -1) {
         cout << "You don't have that item.\n";
         return;
@@ -444,19 +1166,23 @@ void dropItem(const string& name) {
     Item* it = inventory[idx];
     placeItemInRoom((int)(currentRoom - rooms), it); // index of currentRoom
     removeFromInventory(idx);
-    cout << "You drop the " << it->name << ".\n";
+    cout << "You drop the " << text(it->name) << ".\n";
 }
 
 // Use item from inventory
 void useItem(const string& name) {
-    int idx = findItemIndexInInventory(name);
+    int idx = matchItemInInventory(name);
+    if (idx == AMBIGUOUS_MATCH) {
+        cout << "Which one? Be more specific.\n";
+        return;
+    }
     if (idx == -1) {
         cout << "You don't possess that item.\n";
         return;
     }
     Item* it = inventory[idx];
     if (!it->usable) {
-        cout << "You can't use the " << it->name << " right now.\n";
+        cout << "You can't use the " << text(it->name) << " right now.\n";
         return;
     }
 
@@ -465,7 +1191,7 @@ void useItem(const string& name) {
         int heal = it->healAmount;
         playerHP += heal;
         if (playerHP > 100) playerHP = 100;
-        cout << "You use " << it->name << " and recover " << heal << " HP. (HP: " << playerHP << ")\n";
+        cout << "You use " << text(it->name) << " and recover " << heal << " HP. (HP: " << playerHP << ")\n";
         // consume potion or not? We'll consume small potion but keep food? Let's consume any consumable (healAmount>0)
         removeFromInventory(idx);
         return;
@@ -482,7 +1208,7 @@ void useItem(const string& name) {
             if (ri == -1) continue;
             if (rooms[ri].locked && rooms[ri].keyName == it->name) {
                 rooms[ri].locked = false;
-                cout << "You use " << it->name << " to unlock the " << rooms[ri].name << ".\n";
+                cout << "You use " << text(it->name) << " to unlock the " << text(rooms[ri].name) << ".\n";
                 used = true;
                 break;
             }
@@ -494,13 +1220,13 @@ void useItem(const string& name) {
         return;
     }
 
-    cout << "You fiddle with the " << it->name << " but nothing happens.\n";
+    cout << "You fiddle with the " << text(it->name) << " but nothing happens.\n";
 }
 
 // Combat function: returns whether player survived
 bool combat(Enemy* enemy) {
     if (!enemy) return true;
-    cout << "Combat begins: " << enemy->name << " (HP " << enemy->hp << ") vs You (HP " << playerHP << ")\n";
+    cout << "Combat begins: " << text(enemy->name) << " (HP " << enemy->hp << ") vs You (HP " << playerHP << ")\n";
     while (enemy->hp > 0 && playerHP > 0) {
         cout << "\nChoose action: [attack] [use <item>] [flee]\n> ";
         string line;
@@ -515,16 +1241,17 @@ bool combat(Enemy* enemy) {
         } else if (stringStartsWith(cmd, "use ")) {
             string itemName = line.substr(4);
             if (itemName.size() == 0) { cout << "Use what?\n"; continue; }
-            int id = findItemIndexInInventory(itemName);
+            int id = matchItemInInventory(itemName);
+            if (id == AMBIGUOUS_MATCH) { cout << "Which one? Be more specific.\n"; continue; }
             if (id == -1) { cout << "You don't have that item.\n"; continue; }
             Item* it = inventory[id];
             if (it->healAmount > 0) {
-                cout << "You use " << it->name << " mid-battle and heal " << it->healAmount << " HP.\n";
+                cout << "You use " << text(it->name) << " mid-battle and heal " << it->healAmount << " HP.\n";
                 playerHP += it->healAmount;
                 if (playerHP > 100) playerHP = 100;
                 removeFromInventory(id);
             } else {
-                cout << "Using " << it->name << " has no effect in this fight.\n";
+                cout << "Using " << text(it->name) << " has no effect in this fight.\n";
             }
         } else if (stringStartsWith(cmd, "flee")) {
             // attempt flee: 50% success
@@ -540,16 +1267,17 @@ bool combat(Enemy* enemy) {
         }
 
         if (enemy->hp <= 0) {
-            cout << enemy->name << " collapses.\n";
+            cout << text(enemy->name) << " collapses.\n";
             return true;
         }
 
         // Enemy attacks
         int edmg = rnd(enemy->attack - 2, enemy->attack + 3);
-        cout << enemy->name << " attacks and deals " << edmg << " damage.\n";
+        cout << text(enemy->name) << " attacks and deals " << edmg << " damage.\n";
         playerHP -= edmg;
         if (playerHP <= 0) {
             cout << "You have been defeated.\n";
+            killedBy = text(enemy->name);
             return false;
         } else {
             cout << "Your HP: " << playerHP << " | Enemy HP: " << enemy->hp << "\n";
@@ -561,19 +1289,19 @@ bool combat(Enemy* enemy) {
 // Try to engage enemy in current room
 void tryEnemyEncounter() {
     if (!currentRoom->enemy) return;
-    cout << "You encounter " << currentRoom->enemy->name << "!\n";
-    cout << currentRoom->enemy->taunt << "\n";
+    cout << "You encounter " << text(currentRoom->enemy->name) << "!\n";
+    cout << text(currentRoom->enemy->taunt) << "\n";
     bool survived = combat(currentRoom->enemy);
     if (!survived) {
         // player dead
-        cout << "You collapse in the " << currentRoom->name << ". Game over.\n";
+        cout << "You collapse in the " << text(currentRoom->name) << ". Game over.\n";
         // We will end via main loop
         return;
     } else {
         // enemy defeated: remove enemy pointer and maybe drop loot
-        cout << "You defeated " << currentRoom->enemy->name << ".\n";
+        cout << "You defeated " << text(currentRoom->enemy->name) << ".\n";
         // chance to drop an item: small potion or tower key if guardian
-        if (currentRoom->enemy->name == "Tower Guardian") {
+        if (textIs(currentRoom->enemy->name, "Tower Guardian")) {
             cout << "The guardian falls, revealing a heavy key on its chest.\n";
             Item* key = nullptr;
             // find the "Tower Key" in allItems (already exists). We'll just place the existing tower key item into room if not present.
@@ -582,7 +1310,7 @@ void tryEnemyEncounter() {
             if (present == -1) {
                 // find pointer from allItems
                 for (int i=0;i<allItemsCount;i++){
-                    if (allItems[i] && allItems[i]->name == "Tower Key") { key = allItems[i]; break; }
+                    if (allItems[i] && textIs(allItems[i]->name, "Tower Key")) { key = allItems[i]; break; }
                 }
                 if (key) placeItemInRoom((int)(currentRoom - rooms), key);
             }
@@ -592,7 +1320,7 @@ void tryEnemyEncounter() {
                 // find "Small Potion"
                 Item* p = nullptr;
                 for (int i = 0; i < allItemsCount; ++i) {
-                    if (allItems[i] && allItems[i]->name == "Small Potion") { p = allItems[i]; break; }
+                    if (allItems[i] && textIs(allItems[i]->name, "Small Potion")) { p = allItems[i]; break; }
                 }
                 if (p) {
                     cout << "The creature drops a Small Potion.\n";
@@ -607,7 +1335,7 @@ void tryEnemyEncounter() {
 
 // Check win condition after significant actions
 bool checkWinCondition() {
-    if (relicsCollected() >= 3 && currentRoom->name == "Tower" && !currentRoom->enemy) {
+    if (relicsCollected() >= 3 && currentRoom == &rooms[TOWER_ROOM] && !currentRoom->enemy) {
         cout << "\nAs you stand in the Tower with the three relics, they combine into a radiant sigil.\n";
         cout << "A hidden mechanism opens and the manor's curse lifts. You have freed Mystic Manor!\n";
         return true;
@@ -620,7 +1348,7 @@ bool checkWinCondition() {
 int main() {
     srand((unsigned)time(nullptr));
 
-    initRoomsAndItems();
+    loadWorld();
     currentRoom = &rooms[0]; // start in Grand Hall
 
     cout << "Welcome to Mystic Manor! Your goal: find and collect the 3 relics, then reach the Tower and end the curse.\n";
@@ -633,7 +1361,7 @@ int main() {
         showHeader();
         // automatic short prompts if enemy present
         if (currentRoom->enemy) {
-            cout << "Danger: " << currentRoom->enemy->name << " is here. You may 'attack' or 'flee' when prompted.\n";
+            cout << "Danger: " << text(currentRoom->enemy->name) << " is here. You may 'attack' or 'flee' when prompted.\n";
         }
 
         cout << "\n> ";
@@ -657,6 +1385,8 @@ int main() {
             describeCurrentRoom();
         } else if (token == "status") {
             cout << "HP: " << playerHP << ", Attack: " << playerAttack << ", Relics: " << relicsCollected() << "/3\n";
+        } else if (token == "stats") {
+            showStats();
         } else if (token == "map") {
             showMapHint();
         } else if (token == "inv" || token == "inventory") {
@@ -716,6 +1446,8 @@ int main() {
                     if (checkWinCondition()) { gameOver = true; break; }
                 }
             }
+        } else if (token == "reload") {
+            reloadWorld();
         } else if (token == "quit" || token == "exit") {
             cout << "Do you really want to quit? (yes/no): ";
             string ans;
@@ -741,6 +1473,12 @@ int main() {
         cout << "\nCONGRATULATIONS! You have completed the Mystic Manor adventure.\n";
     }
 
+    // add this game to the records kept across runs
+    int rank = recordGameResult(gameOver && playerHP > 0, playerHP <= 0);
+    if (rank > 0) {
+        cout << "Your win of " << movesTaken << " moves is #" << rank << " on the fastest wins board!\n";
+    }
+
     // cleanup dynamic memory
     cleanup();
     return 0;